@@ -0,0 +1,65 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <functional>
+#include "long_numbers.hpp"
+#include "decimal_long_numbers.hpp"
+
+using namespace LongNumbers;
+
+// decimal digit string of the given length
+std::string makeNumber(int length, int seed) {
+    std::string res;
+    for (int i = 0; i < length; i++) {
+        res += static_cast<char>('1' + (i * 7 + seed) % 9);
+    }
+    return res;
+}
+
+double measureMs(const std::function<void()>& workload) {
+    auto start = std::chrono::steady_clock::now();
+    workload();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// parses two numbers, runs the operations and prints the result;
+// the binary side pays for the radix conversion in its own string constructor and toString()
+void runCase(int length, int additions, int multiplications) {
+    std::string x_str = makeNumber(length, 1);
+    std::string y_str = makeNumber(length, 5);
+    size_t output_size = 0;
+
+    double binary_ms = measureMs([&]() {
+        LongNumber x(x_str, 0);
+        LongNumber y(y_str, 0);
+        for (int i = 0; i < additions; i++) { x = x + y; }
+        for (int i = 0; i < multiplications; i++) { x = x * y; }
+        output_size += x.toString().size();
+    });
+
+    double decimal_ms = measureMs([&]() {
+        DecimalLongNumber x(x_str);
+        DecimalLongNumber y(y_str);
+        for (int i = 0; i < additions; i++) { x = x + y; }
+        for (int i = 0; i < multiplications; i++) { x = x * y; }
+        output_size += x.toString().size();
+    });
+
+    std::cout << std::setw(8) << length << std::setw(8) << additions << std::setw(8) << multiplications
+              << std::setw(14) << binary_ms << std::setw(14) << decimal_ms
+              << std::setw(10) << (binary_ms < decimal_ms ? "binary" : "decimal")
+              << "  (" << output_size << " digits printed)\n";
+}
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "  digits    adds   mults   binary (ms)  decimal (ms)    winner\n";
+    for (int length : {19, 190, 1900}) {
+        runCase(length, 1, 0);
+        runCase(length, 1000, 0);
+        runCase(length, 0, 2);
+    }
+    return 0;
+}
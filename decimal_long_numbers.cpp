@@ -0,0 +1,435 @@
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+#include "decimal_long_numbers.hpp"
+
+namespace LongNumbers{
+    namespace {
+        using Limbs = std::vector<uint64_t>;
+        using Wide = unsigned __int128;
+
+        const uint64_t BASE = DecimalLongNumber::BASE;
+        const int BASE_DIGITS = DecimalLongNumber::BASE_DIGITS;
+        // largest power of two that fits into one limb
+        const int LIMB_BITS = 63;
+
+        uint64_t pow10(int k) {
+            uint64_t res = 1;
+            for (int i = 0; i < k; i++) { res *= 10; }
+            return res;
+        }
+
+        // deletes zero limbs in the end, keeps at least one
+        void trim(Limbs& a) {
+            while (a.size() > 1 && a.back() == 0) { a.pop_back(); }
+            if (a.empty()) { a.push_back(0); }
+        }
+
+        bool isZeroMagnitude(const Limbs& a) {
+            return a.size() == 1 && a[0] == 0;
+        }
+
+        // magnitudes must be trimmed
+        int compareMagnitudes(const Limbs& a, const Limbs& b) {
+            if (a.size() != b.size()) { return (a.size() > b.size()) ? 1 : -1; }
+            for (size_t i = a.size(); i-- > 0;) {
+                if (a[i] != b[i]) { return (a[i] > b[i]) ? 1 : -1; }
+            }
+            return 0;
+        }
+
+        Limbs addMagnitudes(const Limbs& a, const Limbs& b) {
+            Limbs res(std::max(a.size(), b.size()) + 1, 0);
+            uint64_t carry = 0;
+            for (size_t i = 0; i < res.size(); i++) {
+                Wide sum = static_cast<Wide>(carry) + (i < a.size() ? a[i] : 0) + (i < b.size() ? b[i] : 0);
+                carry = (sum >= BASE);
+                res[i] = static_cast<uint64_t>(sum - carry * BASE);
+            }
+            trim(res);
+            return res;
+        }
+
+        // a >= b
+        Limbs subtractMagnitudes(const Limbs& a, const Limbs& b) {
+            Limbs res(a.size(), 0);
+            uint64_t borrow = 0;
+            for (size_t i = 0; i < a.size(); i++) {
+                uint64_t subtrahend = (i < b.size() ? b[i] : 0) + borrow;
+                borrow = (a[i] < subtrahend);
+                res[i] = a[i] + borrow * BASE - subtrahend;
+            }
+            trim(res);
+            return res;
+        }
+
+        // a *= factor, factor < 2^64
+        void multiplySmall(Limbs& a, uint64_t factor) {
+            uint64_t carry = 0;
+            for (auto& limb : a) {
+                Wide cur = static_cast<Wide>(limb) * factor + carry;
+                limb = static_cast<uint64_t>(cur % BASE);
+                carry = static_cast<uint64_t>(cur / BASE);
+            }
+            while (carry > 0) {
+                a.push_back(carry % BASE);
+                carry /= BASE;
+            }
+            trim(a);
+        }
+
+        // a /= divisor, divisor <= BASE, returns the remainder
+        uint64_t divideSmall(Limbs& a, uint64_t divisor) {
+            uint64_t remainder = 0;
+            for (size_t i = a.size(); i-- > 0;) {
+                Wide cur = static_cast<Wide>(remainder) * BASE + a[i];
+                a[i] = static_cast<uint64_t>(cur / divisor);
+                remainder = static_cast<uint64_t>(cur % divisor);
+            }
+            trim(a);
+            return remainder;
+        }
+
+        // a *= 10^k
+        void scaleUp(Limbs& a, int k) {
+            a.insert(a.begin(), k / BASE_DIGITS, 0);
+            multiplySmall(a, pow10(k % BASE_DIGITS));
+        }
+
+        // a /= 10^k, truncating
+        void scaleDown(Limbs& a, int k) {
+            size_t whole = std::min(a.size(), static_cast<size_t>(k / BASE_DIGITS));
+            a.erase(a.begin(), a.begin() + whole);
+            trim(a);
+            divideSmall(a, pow10(k % BASE_DIGITS));
+        }
+
+        Limbs multiplyMagnitudes(const Limbs& a, const Limbs& b) {
+            Limbs res(a.size() + b.size(), 0);
+            for (size_t i = 0; i < a.size(); i++) {
+                if (a[i] == 0) { continue; }
+                uint64_t carry = 0;
+                for (size_t j = 0; j < b.size(); j++) {
+                    Wide cur = static_cast<Wide>(a[i]) * b[j] + res[i + j] + carry;
+                    res[i + j] = static_cast<uint64_t>(cur % BASE);
+                    carry = static_cast<uint64_t>(cur / BASE);
+                }
+                res[i + b.size()] = carry;
+            }
+            trim(res);
+            return res;
+        }
+
+        // schoolbook long division (Knuth's algorithm D): both numbers are scaled
+        // so that the leading divisor limb is at least BASE / 2, then every quotient limb
+        // estimated from the leading remainder limbs is at most two too large
+        Limbs divideMagnitudes(const Limbs& a, const Limbs& b) {
+            if (b.size() == 1) {
+                Limbs quotient = a;
+                divideSmall(quotient, b[0]);
+                return quotient;
+            }
+
+            uint64_t factor = BASE / (b.back() + 1);
+            Limbs dividend = a, divisor = b;
+            multiplySmall(dividend, factor);
+            multiplySmall(divisor, factor);
+            uint64_t divisor_head = divisor.back();
+            size_t n = divisor.size();
+
+            Limbs quotient(dividend.size(), 0);
+            Limbs remainder = {0};
+            for (size_t i = dividend.size(); i-- > 0;) {
+                remainder.insert(remainder.begin(), dividend[i]);
+                trim(remainder);
+                if (remainder.size() < n) { continue; }
+
+                // the remainder is less than BASE * divisor, so it has at most n + 1 limbs
+                Wide remainder_head = remainder[n - 1];
+                if (remainder.size() > n) {
+                    remainder_head += static_cast<Wide>(remainder[n]) * BASE;
+                }
+                uint64_t estimate = static_cast<uint64_t>(std::min<Wide>(remainder_head / divisor_head, BASE - 1));
+
+                Limbs product = divisor;
+                multiplySmall(product, estimate);
+                while (compareMagnitudes(product, remainder) > 0) {
+                    estimate--;
+                    product = subtractMagnitudes(product, divisor);
+                }
+                remainder = subtractMagnitudes(remainder, product);
+                quotient[i] = estimate;
+            }
+            trim(quotient);
+            return quotient;
+        }
+    }
+
+    // getters
+    std::vector<uint64_t> DecimalLongNumber::getLimbs() const{
+        return this->limbs;
+    }
+
+    bool DecimalLongNumber::getSign() const{
+        return this->sign;
+    }
+
+    int DecimalLongNumber::getPrecision() const{
+        return this->precision;
+    }
+
+    // setters
+    void DecimalLongNumber::setSign(bool new_sign){
+        this->sign = new_sign;
+    }
+
+    // rescales the number, truncating it if the precision decreases
+    void DecimalLongNumber::setPrecision(int new_precision){
+        if (new_precision > this->precision) {
+            scaleUp(this->limbs, new_precision - this->precision);
+        } else {
+            scaleDown(this->limbs, this->precision - new_precision);
+        }
+        this->precision = new_precision;
+        normalize();
+    }
+
+    // auxiliary functions
+
+    // deletes zero limbs in the end
+    void DecimalLongNumber::normalize(){
+        trim(this->limbs);
+
+        // there is no negative zero
+        if (this->isZero()) {
+            this->sign = 0;
+        }
+    }
+
+    DecimalLongNumber DecimalLongNumber::abs() const{
+        DecimalLongNumber res = *this;
+        res.setSign(0);
+        return res;
+    }
+
+    bool DecimalLongNumber::isZero() const{
+        return isZeroMagnitude(this->limbs);
+    }
+
+    // constructors
+
+    // no arguments constructor (aka 0)
+    DecimalLongNumber::DecimalLongNumber() : limbs({0}), sign(0), precision(0) {};
+
+    // string constructor, extra fraction digits are truncated
+    DecimalLongNumber::DecimalLongNumber(std::string num, int prec) : sign(0), precision(prec) {
+        if (num.empty()) {
+            throw std::invalid_argument("Empty string cannot be converted to DecimalLongNumber.");
+        }
+
+        this->sign = (num[0] == '-');
+        if (this->sign) num = num.substr(1);
+
+        size_t dot_pos = num.find('.');
+        std::string digits = (dot_pos == std::string::npos) ? num : num.substr(0, dot_pos);
+        std::string fraction_str = (dot_pos == std::string::npos) ? "" : num.substr(dot_pos + 1);
+        fraction_str.resize(precision, '0');
+        digits += fraction_str;
+
+        // one limb per 19 digits, starting from the end
+        for (size_t end = digits.size(); end > 0;) {
+            size_t start = (end > BASE_DIGITS) ? end - BASE_DIGITS : 0;
+            uint64_t limb = 0;
+            for (size_t i = start; i < end; i++) {
+                if (digits[i] < '0' || digits[i] > '9') {
+                    throw std::invalid_argument("String cannot be converted to DecimalLongNumber.");
+                }
+                limb = limb * 10 + (digits[i] - '0');
+            }
+            this->limbs.push_back(limb);
+            end = start;
+        }
+
+        normalize();
+    }
+
+    // LongNumber constructor, truncates the value to the given precision
+    DecimalLongNumber::DecimalLongNumber(const LongNumber& num, int prec) : sign(num.getSign()), precision(prec) {
+        std::vector<short> digits = num.getDigits();
+        unsigned long int frac_bits = digits.size() - num.getPointId();
+
+        // all the binary digits read as an integer, 63 bits at a time
+        this->limbs = {0};
+        for (size_t start = 0; start < digits.size(); start += LIMB_BITS) {
+            size_t end = std::min(digits.size(), start + LIMB_BITS);
+            uint64_t chunk = 0;
+            for (size_t i = start; i < end; i++) {
+                chunk = chunk * 2 + digits[i];
+            }
+            multiplySmall(this->limbs, uint64_t(1) << (end - start));
+            this->limbs = addMagnitudes(this->limbs, {chunk});
+        }
+
+        // value * 10^precision / 2^frac_bits
+        scaleUp(this->limbs, precision);
+        while (frac_bits > 0) {
+            int shift = std::min<unsigned long int>(frac_bits, LIMB_BITS);
+            divideSmall(this->limbs, uint64_t(1) << shift);
+            frac_bits -= shift;
+        }
+
+        normalize();
+    }
+
+    // arithmetic operators
+    DecimalLongNumber DecimalLongNumber::operator + (const DecimalLongNumber& other) const{
+        DecimalLongNumber a = *this, b = other;
+        int precision = std::max(a.precision, b.precision);
+        a.setPrecision(precision);
+        b.setPrecision(precision);
+
+        DecimalLongNumber res;
+        res.precision = precision;
+        if (a.sign == b.sign) {
+            res.limbs = addMagnitudes(a.limbs, b.limbs);
+            res.sign = a.sign;
+        } else if (compareMagnitudes(a.limbs, b.limbs) >= 0) {
+            res.limbs = subtractMagnitudes(a.limbs, b.limbs);
+            res.sign = a.sign;
+        } else {
+            res.limbs = subtractMagnitudes(b.limbs, a.limbs);
+            res.sign = b.sign;
+        }
+        res.normalize();
+        return res;
+    }
+
+    DecimalLongNumber DecimalLongNumber::operator - (const DecimalLongNumber& other) const{
+        // a - b = a + (-b)
+        DecimalLongNumber new_other = other;
+        new_other.setSign(!other.getSign());
+        return *this + new_other;
+    }
+
+    // the product is truncated to the larger of the operands' precisions, as in LongNumber
+    DecimalLongNumber DecimalLongNumber::operator * (const DecimalLongNumber& other) const{
+        DecimalLongNumber res;
+        res.limbs = multiplyMagnitudes(this->limbs, other.limbs);
+        res.sign = this->sign ^ other.sign;
+        res.precision = this->precision + other.precision;
+        res.setPrecision(std::max(this->precision, other.precision));
+        return res;
+    }
+
+    // the quotient is truncated to the larger of the operands' precisions
+    DecimalLongNumber DecimalLongNumber::operator / (const DecimalLongNumber& other) const{
+        if (other.isZero()) {
+            throw std::invalid_argument("Division by zero.");
+        }
+
+        int precision = std::max(this->precision, other.precision);
+        Limbs dividend = this->limbs;
+        scaleUp(dividend, precision + other.precision - this->precision);
+
+        DecimalLongNumber res;
+        res.limbs = divideMagnitudes(dividend, other.limbs);
+        res.sign = this->sign ^ other.sign;
+        res.precision = precision;
+        res.normalize();
+        return res;
+    }
+
+    // comparison operators
+    bool DecimalLongNumber::operator == (const DecimalLongNumber& other) const{
+        DecimalLongNumber a = *this, b = other;
+        int precision = std::max(a.precision, b.precision);
+        a.setPrecision(precision);
+        b.setPrecision(precision);
+        return a.sign == b.sign && a.limbs == b.limbs;
+    }
+
+    bool DecimalLongNumber::operator != (const DecimalLongNumber& other) const{
+        return !(*this == other);
+    }
+
+    bool DecimalLongNumber::operator > (const DecimalLongNumber& other) const{
+        if (*this == other) { return false; }
+
+        if (this->sign == 1 && other.getSign() == 0){ return false; }
+        if (this->sign == 0 && other.getSign() == 1){ return true; }
+
+        // signs are the same
+        // -> comparing the magnitudes
+        DecimalLongNumber a = *this, b = other;
+        int precision = std::max(a.precision, b.precision);
+        a.setPrecision(precision);
+        b.setPrecision(precision);
+
+        bool greater_magnitude = compareMagnitudes(a.limbs, b.limbs) > 0;
+        return (this->sign == 0) ? greater_magnitude : !greater_magnitude;
+    }
+
+    bool DecimalLongNumber::operator >= (const DecimalLongNumber& other) const{
+        return (*this == other || *this > other);
+    }
+
+    bool DecimalLongNumber::operator <= (const DecimalLongNumber& other) const{
+        return !(*this > other);
+    }
+
+    bool DecimalLongNumber::operator < (const DecimalLongNumber& other) const{
+        return !(*this >= other);
+    }
+
+    // output methods
+    std::string DecimalLongNumber::toString() const{
+        // limbs -> digits, every limb but the most significant one is padded to 19 digits
+        std::string digits = std::to_string(this->limbs.back());
+        digits.reserve(this->limbs.size() * BASE_DIGITS);
+        for (size_t i = this->limbs.size() - 1; i-- > 0;) {
+            std::string limb = std::to_string(this->limbs[i]);
+            digits.append(BASE_DIGITS - limb.size(), '0');
+            digits += limb;
+        }
+
+        if (digits.size() <= static_cast<size_t>(this->precision)) {
+            digits.insert(0, this->precision + 1 - digits.size(), '0');
+        }
+        if (this->precision > 0) {
+            digits.insert(digits.size() - this->precision, ".");
+        }
+
+        return (this->sign ? "-" : "") + digits;
+    }
+
+    LongNumber DecimalLongNumber::toLongNumber(int prec) const{
+        // value * 2^prec, truncated to an integer
+        Limbs value = this->limbs;
+        for (int shifted = 0; shifted < prec;) {
+            int shift = std::min(prec - shifted, LIMB_BITS);
+            multiplySmall(value, uint64_t(1) << shift);
+            shifted += shift;
+        }
+        scaleDown(value, this->precision);
+
+        // integer -> binary digits, 63 at a time from the least significant ones
+        std::vector<short> digits;
+        while (!isZeroMagnitude(value)) {
+            uint64_t chunk = divideSmall(value, uint64_t(1) << LIMB_BITS);
+            for (int i = 0; i < LIMB_BITS; i++) {
+                digits.push_back(chunk % 2);
+                chunk /= 2;
+            }
+        }
+        digits.resize(std::max(digits.size(), static_cast<size_t>(prec) + 1), 0);
+        std::reverse(digits.begin(), digits.end());
+
+        LongNumber res;
+        res.setDigits(digits);
+        res.setPointId(digits.size() - prec);
+        res.setSign(this->sign);
+        res.setPrecision(prec);
+        return res;
+    }
+} // namespace LongNumbers
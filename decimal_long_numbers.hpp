@@ -0,0 +1,64 @@
+#ifndef HEADER_GUARD_DECIMAL_LONG_NUMBERS_HPP_INCLUDED
+#define HEADER_GUARD_DECIMAL_LONG_NUMBERS_HPP_INCLUDED
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "long_numbers.hpp"
+
+namespace LongNumbers {
+    // fixed point number stored in base 10^19 limbs: parsing and printing are linear,
+    // so it suits workloads dominated by decimal input and output.
+    // Value is limbs * 10^(-precision), precision counts decimal digits after the point
+    class DecimalLongNumber{
+
+    private:
+        std::vector<uint64_t> limbs; // least significant first
+        bool sign;
+        int precision;
+
+    public:
+        static constexpr uint64_t BASE = 10000000000000000000ull;
+        static constexpr int BASE_DIGITS = 19;
+
+        // getters
+        std::vector<uint64_t> getLimbs() const;
+        bool getSign() const;
+        int getPrecision() const;
+
+        // setters
+        void setSign(bool new_sign);
+        void setPrecision(int new_precision);
+
+        //auxiliary functions
+        void normalize();
+        DecimalLongNumber abs() const;
+        bool isZero() const;
+
+        // constructors
+        DecimalLongNumber();
+        DecimalLongNumber(std::string num, int prec=0);
+        DecimalLongNumber(const LongNumber& num, int prec);
+
+        // arithmetic operators
+        DecimalLongNumber operator + (const DecimalLongNumber& other) const;
+        DecimalLongNumber operator - (const DecimalLongNumber& other) const;
+        DecimalLongNumber operator * (const DecimalLongNumber& other) const;
+        DecimalLongNumber operator / (const DecimalLongNumber& other) const;
+
+        // comparison operators
+        bool operator == (const DecimalLongNumber& other) const;
+        bool operator != (const DecimalLongNumber& other) const;
+        bool operator > (const DecimalLongNumber& other) const;
+        bool operator >= (const DecimalLongNumber& other) const;
+        bool operator <= (const DecimalLongNumber& other) const;
+        bool operator < (const DecimalLongNumber& other) const;
+
+        // output methods
+        std::string toString() const;
+        // truncated to the given amount of binary digits after the point
+        LongNumber toLongNumber(int prec) const;
+    };
+}
+
+#endif
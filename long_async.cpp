@@ -0,0 +1,186 @@
+#include <atomic>
+#include <set>
+#include <algorithm>
+#include "long_async.hpp"
+
+namespace LongNumbers{
+    class JobState;
+
+    namespace {
+        // jobs that are queued or running, cancelled when the shared pool shuts down
+        std::mutex& liveJobsMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        std::set<JobState*>& liveJobs() {
+            static std::set<JobState*> jobs;
+            return jobs;
+        }
+    }
+
+    // cancellation flag and progress of one job, observed by the worker running it
+    class JobState : public ComputationObserver{
+
+    private:
+        std::atomic<bool> cancelled;
+        std::atomic<double> progress;
+        ProgressCallback on_progress;
+
+    public:
+        JobState(ProgressCallback on_progress) : cancelled(false), progress(0.0), on_progress(on_progress) {
+            std::lock_guard<std::mutex> lock(liveJobsMutex());
+            liveJobs().insert(this);
+        };
+
+        ~JobState() {
+            std::lock_guard<std::mutex> lock(liveJobsMutex());
+            liveJobs().erase(this);
+        }
+
+        void cancel() { cancelled = true; }
+        double getProgress() const { return progress; }
+
+        bool isCancelled() const override { return cancelled; }
+
+        void onProgress(double done) override {
+            progress = done;
+            if (on_progress) {
+                on_progress(done);
+            }
+        }
+    };
+
+    namespace {
+        LongJob submitJob(std::function<LongNumber()> computation, ProgressCallback on_progress) {
+            auto state = std::make_shared<JobState>(on_progress);
+            auto promise = std::make_shared<std::promise<LongNumber>>();
+            std::shared_future<LongNumber> result = promise->get_future().share();
+
+            ThreadPool::shared().submit([state, promise, computation]() {
+                ComputationObserver* previous = getObserver();
+                setObserver(state.get());
+                try {
+                    if (state->isCancelled()) {
+                        throw ComputationCancelled();
+                    }
+                    LongNumber res = computation();
+                    state->onProgress(1.0);
+                    promise->set_value(res);
+                } catch (...) {
+                    promise->set_exception(std::current_exception());
+                }
+                setObserver(previous);
+            });
+
+            return LongJob(state, result);
+        }
+    }
+
+    // thread pool
+
+    ThreadPool::ThreadPool(unsigned int threads) : stopping(false) {
+        for (unsigned int i = 0; i < threads; i++) {
+            workers.emplace_back(&ThreadPool::work, this);
+        }
+    }
+
+    // finishes the queued tasks before joining the workers
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (tasks.empty()) { return; }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push(std::move(task));
+        }
+        condition.notify_one();
+    }
+
+    ThreadPool& ThreadPool::shared() {
+        // at exit the jobs are cancelled before the workers are joined, so queued jobs
+        // fail at once and running ones stop at their next checkpoint
+        struct SharedPool {
+            ThreadPool pool;
+
+            SharedPool() : pool(std::max(1u, std::thread::hardware_concurrency())) {
+                // the registry is created first, so it is destroyed after the pool
+                liveJobs();
+                liveJobsMutex();
+            }
+
+            ~SharedPool() {
+                std::lock_guard<std::mutex> lock(liveJobsMutex());
+                for (auto job : liveJobs()) {
+                    job->cancel();
+                }
+            }
+        };
+
+        static SharedPool shared_pool;
+        return shared_pool.pool;
+    }
+
+    // jobs
+
+    LongJob::LongJob(std::shared_ptr<JobState> state, std::shared_future<LongNumber> result)
+        : state(state), result(result) {};
+
+    void LongJob::cancel() {
+        state->cancel();
+    }
+
+    bool LongJob::isCancelled() const {
+        return state->isCancelled();
+    }
+
+    bool LongJob::isReady() const {
+        return result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    double LongJob::getProgress() const {
+        return state->getProgress();
+    }
+
+    void LongJob::wait() const {
+        result.wait();
+    }
+
+    LongNumber LongJob::get() const {
+        return result.get();
+    }
+
+    LongJob asyncMultiply(const LongNumber& a, const LongNumber& b, ProgressCallback on_progress) {
+        return submitJob([a, b]() { return a * b; }, on_progress);
+    }
+
+    LongJob asyncDivide(const LongNumber& a, const LongNumber& b, ProgressCallback on_progress) {
+        return submitJob([a, b]() { return a / b; }, on_progress);
+    }
+
+    LongJob asyncComputePi(int precision, ProgressCallback on_progress) {
+        return submitJob([precision]() { return computePi(precision); }, on_progress);
+    }
+} // namespace LongNumbers
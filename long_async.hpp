@@ -0,0 +1,71 @@
+#ifndef HEADER_GUARD_LONG_ASYNC_HPP_INCLUDED
+#define HEADER_GUARD_LONG_ASYNC_HPP_INCLUDED
+
+#include <vector>
+#include <queue>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include "long_numbers.hpp"
+
+namespace LongNumbers {
+    // fixed set of worker threads running queued tasks in order
+    class ThreadPool{
+
+    private:
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool stopping;
+
+        void work();
+
+    public:
+        // constructors and destructors
+        explicit ThreadPool(unsigned int threads);
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator = (const ThreadPool& other) = delete;
+        ~ThreadPool();
+
+        void submit(std::function<void()> task);
+
+        // pool shared by all the async functions, one worker per hardware thread
+        static ThreadPool& shared();
+    };
+
+    // called from the worker thread with the fraction of work done
+    using ProgressCallback = std::function<void(double)>;
+
+    class JobState;
+
+    // handle of a computation running in the shared pool
+    class LongJob{
+
+    private:
+        std::shared_ptr<JobState> state;
+        std::shared_future<LongNumber> result;
+
+    public:
+        LongJob(std::shared_ptr<JobState> state, std::shared_future<LongNumber> result);
+
+        // asks the computation to stop, get() then throws ComputationCancelled
+        void cancel();
+        bool isCancelled() const;
+        bool isReady() const;
+        double getProgress() const;
+
+        void wait() const;
+        // rethrows the exception of the computation, if any
+        LongNumber get() const;
+    };
+
+    LongJob asyncMultiply(const LongNumber& a, const LongNumber& b, ProgressCallback on_progress=nullptr);
+    LongJob asyncDivide(const LongNumber& a, const LongNumber& b, ProgressCallback on_progress=nullptr);
+    LongJob asyncComputePi(int precision, ProgressCallback on_progress=nullptr);
+}
+
+#endif
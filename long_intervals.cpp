@@ -0,0 +1,215 @@
+#include <vector>
+#include <math.h>
+#include <algorithm>
+#include <stdexcept>
+#include "long_intervals.hpp"
+
+namespace LongNumbers{
+    namespace {
+        // largest number with the given precision that is <= value
+        LongNumber roundDown(const LongNumber& value, int precision) {
+            LongNumber res = value;
+            res.setPrecision(precision);
+            if (res > value) {
+                res = res - ulp(precision);
+            }
+            return res;
+        }
+
+        // smallest number with the given precision that is >= value
+        LongNumber roundUp(const LongNumber& value, int precision) {
+            LongNumber res = value;
+            res.setPrecision(precision);
+            if (res < value) {
+                res = res + ulp(precision);
+            }
+            return res;
+        }
+    }
+
+    // getters
+    LongNumber LongInterval::getLower() const{
+        return this->lower;
+    }
+
+    LongNumber LongInterval::getUpper() const{
+        return this->upper;
+    }
+
+    int LongInterval::getPrecision() const{
+        return std::max(this->lower.getPrecision(), this->upper.getPrecision());
+    }
+
+    // auxiliary functions
+    LongNumber LongInterval::width() const{
+        return this->upper - this->lower;
+    }
+
+    bool LongInterval::contains(const LongNumber& value) const{
+        return this->lower <= value && value <= this->upper;
+    }
+
+    bool LongInterval::containsZero() const{
+        return contains(LongNumber());
+    }
+
+    // constructors
+
+    // no arguments constructor (aka [0, 0])
+    LongInterval::LongInterval() : lower(), upper() {};
+
+    // exact value
+    LongInterval::LongInterval(const LongNumber& value) : lower(value), upper(value) {};
+
+    LongInterval::LongInterval(const std::string& num, int precision) {
+        // rounded to the nearest, so less than one ulp away from the decimal number
+        LongNumber value(num, precision);
+
+        // the value is exact if value * 10^(fraction digits) gives back the digits without the point
+        std::string integer_digits = (num[0] == '-') ? num.substr(1) : num;
+        size_t dot_pos = integer_digits.find('.');
+        size_t fraction_size = (dot_pos == std::string::npos) ? 0 : integer_digits.size() - dot_pos - 1;
+        if (dot_pos != std::string::npos) {
+            integer_digits.erase(dot_pos, 1);
+        }
+        if (integer_digits.empty()) {
+            integer_digits = "0";
+        }
+
+        LongNumber scale("1" + std::string(fraction_size, '0'));
+        if (exactProduct(value.abs(), scale) == LongNumber(integer_digits)) {
+            this->lower = value;
+            this->upper = value;
+        } else {
+            LongNumber error = ulp(precision);
+            this->lower = value - error;
+            this->upper = value + error;
+        }
+    };
+
+    LongInterval::LongInterval(const LongNumber& lower, const LongNumber& upper) : lower(lower), upper(upper) {
+        if (lower > upper) {
+            throw std::invalid_argument("Lower bound of LongInterval is greater than the upper one.");
+        }
+    };
+
+    // arithmetic operators
+
+    // sums and differences of LongNumbers are exact, so no rounding is needed
+    LongInterval LongInterval::operator + (const LongInterval& other) const{
+        return LongInterval(this->lower + other.lower, this->upper + other.upper);
+    }
+
+    LongInterval LongInterval::operator - (const LongInterval& other) const{
+        return LongInterval(this->lower - other.upper, this->upper - other.lower);
+    }
+
+    LongInterval LongInterval::operator * (const LongInterval& other) const{
+        int precision = std::max(this->getPrecision(), other.getPrecision());
+
+        // the exact products are rounded outwards below
+        std::vector<LongNumber> products = {
+            exactProduct(this->lower, other.lower), exactProduct(this->lower, other.upper),
+            exactProduct(this->upper, other.lower), exactProduct(this->upper, other.upper)
+        };
+        LongNumber min_product = *std::min_element(products.begin(), products.end());
+        LongNumber max_product = *std::max_element(products.begin(), products.end());
+
+        return LongInterval(roundDown(min_product, precision), roundUp(max_product, precision));
+    }
+
+    LongInterval LongInterval::operator / (const LongInterval& other) const{
+        if (other.containsZero()) {
+            throw std::invalid_argument("Division by LongInterval containing zero.");
+        }
+        int precision = std::max(this->getPrecision(), other.getPrecision());
+
+        std::vector<LongNumber> lower_bounds, upper_bounds;
+        for (const LongNumber* dividend : {&this->lower, &this->upper}) {
+            for (const LongNumber* divisor : {&other.lower, &other.upper}) {
+                LongNumber x = *dividend;
+                if (x.getPrecision() < precision) {
+                    x.setPrecision(precision);
+                }
+                LongNumber quotient = x / *divisor;
+
+                // a truncated quotient is less than one ulp away from the exact one
+                if (exactProduct(quotient, *divisor) == x) {
+                    lower_bounds.push_back(quotient);
+                    upper_bounds.push_back(quotient);
+                } else {
+                    LongNumber error = ulp(quotient.getPrecision());
+                    lower_bounds.push_back(quotient - error);
+                    upper_bounds.push_back(quotient + error);
+                }
+            }
+        }
+        LongNumber min_bound = *std::min_element(lower_bounds.begin(), lower_bounds.end());
+        LongNumber max_bound = *std::max_element(upper_bounds.begin(), upper_bounds.end());
+
+        return LongInterval(roundDown(min_bound, precision), roundUp(max_bound, precision));
+    }
+
+    LongNumber ulp(int precision) {
+        std::vector<short> digits(precision + 1, 0);
+        digits.back() = 1;
+
+        LongNumber res;
+        res.setDigits(digits);
+        res.setPointId(1);
+        res.setPrecision(precision);
+        return res;
+    }
+
+    int decimalDigitsToPrecision(int decimal_digits) {
+        return static_cast<int>(ceil(decimal_digits * log2(10.0)));
+    }
+
+    namespace {
+        // Ziv loop behind both evaluate functions: the first working precision has a few guard bits
+        // over target_bits, and the enclosure is rounded down to the given precision
+        LongNumber evaluateAt(const std::function<LongInterval(int)>& computation, int target_bits, int precision,
+                              int guard_bits, int max_precision) {
+            int working_precision = std::min(target_bits + std::max(guard_bits, 1), max_precision);
+
+            while (true) {
+                LongInterval result = computation(working_precision);
+                LongNumber lower = roundDown(result.getLower(), precision);
+                LongNumber upper = roundDown(result.getUpper(), precision);
+                if (lower == upper) {
+                    return lower;
+                }
+                // an interval narrower than one ulp holds a single grid point, upper;
+                // if the exact value lies on it no precision can separate the bounds
+                if (result.width() < ulp(precision)) {
+                    return upper;
+                }
+
+                if (working_precision >= max_precision) {
+                    break;
+                }
+                // doubling the guard bits
+                working_precision = std::min(target_bits + 2 * (working_precision - target_bits), max_precision);
+            }
+
+            throw std::runtime_error("Result cannot be rounded within the maximum precision.");
+        }
+    }
+
+    LongNumber evaluate(const std::function<LongInterval(int)>& computation, int precision,
+                        int guard_bits, int max_precision) {
+        return evaluateAt(computation, precision, precision, guard_bits, max_precision);
+    }
+
+    DecimalLongNumber evaluateDecimal(const std::function<LongInterval(int)>& computation, int decimal_digits,
+                                      int guard_bits, int max_precision) {
+        // the result times 10^decimal_digits is rounded down to an integer;
+        // multiplying the bounds by an integer is exact
+        LongNumber scale("1" + std::string(decimal_digits, '0'));
+        LongNumber scaled = evaluateAt([&](int precision) { return computation(precision) * LongInterval(scale); },
+                                       decimalDigitsToPrecision(decimal_digits), 0, guard_bits, max_precision);
+
+        // exact, as the scaled result is an integer
+        return DecimalLongNumber(scaled, decimal_digits) / DecimalLongNumber(scale, 0);
+    }
+} // namespace LongNumbers
@@ -0,0 +1,64 @@
+#ifndef HEADER_GUARD_LONG_INTERVALS_HPP_INCLUDED
+#define HEADER_GUARD_LONG_INTERVALS_HPP_INCLUDED
+
+#include <string>
+#include <functional>
+#include "long_numbers.hpp"
+#include "decimal_long_numbers.hpp"
+
+namespace LongNumbers {
+    // closed interval [lower, upper] that is guaranteed to contain the exact value;
+    // every operation rounds the lower bound down and the upper bound up
+    class LongInterval{
+
+    private:
+        LongNumber lower;
+        LongNumber upper;
+
+    public:
+        // getters
+        LongNumber getLower() const;
+        LongNumber getUpper() const;
+        int getPrecision() const;
+
+        // auxiliary functions
+        LongNumber width() const;
+        bool contains(const LongNumber& value) const;
+        bool containsZero() const;
+
+        // constructors
+        LongInterval();
+        LongInterval(const LongNumber& value);
+        // decimal number, widened by one ulp on each side unless it is exact at the precision
+        LongInterval(const std::string& num, int precision);
+        LongInterval(const LongNumber& lower, const LongNumber& upper);
+
+        // arithmetic operators
+        LongInterval operator + (const LongInterval& other) const;
+        LongInterval operator - (const LongInterval& other) const;
+        LongInterval operator * (const LongInterval& other) const;
+        LongInterval operator / (const LongInterval& other) const;
+    };
+
+    // 2^(-precision)
+    LongNumber ulp(int precision);
+
+    // binary precision enough to hold the given amount of decimal digits
+    int decimalDigitsToPrecision(int decimal_digits);
+
+    // Ziv loop: runs the computation with a few guard bits over the requested precision
+    // and retries with more of them until both bounds round down to the same number.
+    // Returns the exact value rounded down to the precision; once the interval is narrower
+    // than one ulp but still holds a grid point (as exact results like 0.1 * 5 do), that point
+    // is returned, so the result is then at most one ulp above the exact value.
+    // Throws if max_precision is not enough
+    LongNumber evaluate(const std::function<LongInterval(int)>& computation, int precision,
+                        int guard_bits=8, int max_precision=4096);
+
+    // the same loop for a result correct to the given amount of decimal digits after the point:
+    // returns the exact value rounded down to them, under the same rule for grid points
+    DecimalLongNumber evaluateDecimal(const std::function<LongInterval(int)>& computation, int decimal_digits,
+                                      int guard_bits=8, int max_precision=4096);
+}
+
+#endif
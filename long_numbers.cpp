@@ -6,6 +6,45 @@
 #include "long_numbers.hpp"
 
 namespace LongNumbers{
+    namespace {
+        thread_local ComputationObserver* current_observer = nullptr;
+        thread_local int loop_depth = 0;
+
+        // checkpoint of a long-running loop for the current observer
+        class ProgressLoop{
+        private:
+            bool outermost;
+            long last_percent;
+
+        public:
+            ProgressLoop() : outermost(++loop_depth == 1), last_percent(-1) {};
+            ~ProgressLoop() { loop_depth--; }
+
+            void step(size_t done, size_t total) {
+                if (current_observer == nullptr) { return; }
+                if (current_observer->isCancelled()) {
+                    throw ComputationCancelled();
+                }
+
+                long percent = (total == 0) ? 100 : static_cast<long>(done * 100 / total);
+                if (outermost && percent != last_percent) {
+                    last_percent = percent;
+                    current_observer->onProgress(percent / 100.0);
+                }
+            }
+        };
+    }
+
+    ComputationCancelled::ComputationCancelled() : std::runtime_error("Computation was cancelled.") {};
+
+    void setObserver(ComputationObserver* observer){
+        current_observer = observer;
+    }
+
+    ComputationObserver* getObserver(){
+        return current_observer;
+    }
+
     // getters
     std::vector<short> LongNumber::getDigits() const{
         return this->digits;
@@ -51,7 +90,7 @@ namespace LongNumbers{
 
     // deletes zeros in the beginning and fixes precision
     void LongNumber::normalize() {
-        while (this->digits.size() > this->point_id && this->digits.front() == 0) {
+        while (this->point_id > 1 && this->digits.front() == 0) {
             this->digits.erase(this->digits.begin());
             this->point_id--;
         }
@@ -59,20 +98,31 @@ namespace LongNumbers{
         if (this->digits.size() > this->point_id + this->precision) {
             this->digits.resize(this->point_id + this->precision);
         }
+        if (this->digits.empty()) {
+            this->digits.push_back(0);
+            this->point_id = 1;
+        }
+
+        // there is no negative zero
+        if (this->isZero()) {
+            this->sign = 0;
+        }
     }    
 
-    // for division operator
+    // pads with zeros so that both integer and fraction parts
+    // are at least as long as the other number's ones
     void LongNumber::alignPrecision(LongNumber const& other) {
-        auto max_precision = std::max(this->precision, other.getPrecision());
-        while (this->point_id < max_precision) {
+        this->precision = std::max(this->precision, other.getPrecision());
+
+        unsigned long int this_frac = this->digits.size() - this->point_id;
+        unsigned long int other_frac = other.digits.size() - other.point_id;
+        while (this_frac < other_frac) {
             this->digits.push_back(0);
-            // this->point_id++;
+            this_frac++;
         }
-        int p1 = this->precision;
-        int p2 = other.getPrecision();
-        int p = std::max(p1, p2);
-        while (p1 < p2) {
+        while (this->point_id < other.point_id) {
             this->digits.insert(this->digits.begin(), 0);
+            this->point_id++;
         }
     }
 
@@ -107,27 +157,42 @@ namespace LongNumbers{
         std::string integer_str = (dot_pos == std::string::npos) ? num : num.substr(0, dot_pos);
         std::string fraction_str = (dot_pos == std::string::npos) ? "" : num.substr(dot_pos + 1);
     
-        unsigned long long integer_val = 0;
-        if (!integer_str.empty()) {
-            integer_val = std::stoull(integer_str);
+        for (char c : integer_str + fraction_str) {
+            if (c < '0' || c > '9') {
+                throw std::invalid_argument("String cannot be converted to LongNumber.");
+            }
         }
-        
+
+        // decimal integer -> binary integer:
+        // halving the digit string, the remainders are the binary digits
+        std::string integer_left = integer_str.empty() ? "0" : integer_str;
         do {
-            digits.insert(digits.begin(), integer_val % 2);
-            integer_val /= 2;
-        } while (integer_val > 0);
+            std::string halved;
+            int remainder = 0;
+            for (char c : integer_left) {
+                int cur = remainder * 10 + (c - '0');
+                if (!halved.empty() || cur / 2 != 0) {
+                    halved += static_cast<char>('0' + cur / 2);
+                }
+                remainder = cur % 2;
+            }
+            digits.insert(digits.begin(), remainder);
+            integer_left = halved;
+        } while (!integer_left.empty());
     
         this->point_id = digits.size();
     
-        double fraction_val = fraction_str.empty() ? 0.0 : std::stod("0." + fraction_str);
+        // decimal fraction -> binary fraction:
+        // doubling the digit string, the carries out of it are the binary digits
         std::vector<short> frac_digits;
-    
         for (int i = 0; i < precision + 1; i++) {
-            fraction_val *= 2;
-            frac_digits.push_back(static_cast<short>(fraction_val));
-            if (fraction_val >= 1.0) {
-                fraction_val -= 1.0;
+            int carry = 0;
+            for (size_t j = fraction_str.size(); j-- > 0;) {
+                int cur = (fraction_str[j] - '0') * 2 + carry;
+                fraction_str[j] = static_cast<char>('0' + cur % 10);
+                carry = cur / 10;
             }
+            frac_digits.push_back(carry);
         }
     
         if (frac_digits.size() > precision && frac_digits[precision] == 1) {
@@ -248,22 +313,36 @@ namespace LongNumbers{
         a.alignPrecision(b);
         b.alignPrecision(a);
     
-        std::vector<short> result_digits(std::max(a.digits.size(), b.digits.size()) + 1, 0);
-    
-        int carry = 0;
-        for (int i = result_digits.size() - 1; i >= 0; i--) {
-            // int sum = (i < a.digits.size() ? a.digits[i] : 0) +
-            //           (i < b.digits.size() ? b.digits[i] : 0) +
-            //           carry;
-            int sum = a.digits[i] + b.digits[i] + carry;
-            result_digits[i] = sum % 2;
-            carry = sum / 2;
+        // one extra digit in front for the carry
+        std::vector<short> result_digits(a.digits.size() + 1, 0);
+
+        LongNumber res;
+        if (a.sign == b.sign) {
+            int carry = 0;
+            for (int i = a.digits.size() - 1; i >= 0; i--) {
+                int sum = a.digits[i] + b.digits[i] + carry;
+                result_digits[i + 1] = sum % 2;
+                carry = sum / 2;
+            }
+            result_digits[0] = carry;
+            res.setSign(a.sign);
+        } else {
+            // signs differ -> subtracting the smaller magnitude from the larger one
+            // (digits are aligned, so lexicographic order is the order of magnitudes)
+            const LongNumber& larger = (a.digits >= b.digits) ? a : b;
+            const LongNumber& smaller = (a.digits >= b.digits) ? b : a;
+            int borrow = 0;
+            for (int i = a.digits.size() - 1; i >= 0; i--) {
+                int diff = larger.digits[i] - smaller.digits[i] - borrow;
+                borrow = (diff < 0);
+                result_digits[i + 1] = diff + 2 * borrow;
+            }
+            res.setSign(larger.sign);
         }
     
-        LongNumber res;
+        res.precision = a.precision;
         res.setDigits(result_digits);
-        res.setPointId(a.getPointId());
-        res.setSign(this->sign);
+        res.setPointId(a.getPointId() + 1);
         res.normalize();
         return res;
     }
@@ -277,59 +356,57 @@ namespace LongNumbers{
         return *this + new_other;
     }
 
+    // the product is truncated to the larger of the operands' precisions, like the sum and the quotient
     LongNumber LongNumber::operator * (LongNumber const& other) const{
-        LongNumber multiplicand = this->abs();
-        LongNumber multiplier = other.abs();
-        std::vector<short> multiplicand_digits = multiplicand.getDigits();
-        std::vector<short> multiplier_digits = multiplier.getDigits();
-
-        LongNumber res;
-        bool res_sign = this->sign ^ other.sign;
-        res.setSign(res_sign);
-        res.setPointId(multiplicand.getPointId() + multiplier.getPointId());
-
-        std::vector<short> temp_res(multiplicand_digits.size() + multiplier_digits.size(), 0);
-        for (auto i = 0; i < multiplicand_digits.size(); i++) {
-            for (auto j = 0; j < multiplier_digits.size(); j++) {
-                temp_res[i + j] += multiplicand_digits[i] * multiplier_digits[j];
-            }
-        }
-
-        for (auto i = 0; i < temp_res.size() - 1; i++) {
-            if (temp_res[i] >= 2) {
-                temp_res[i + 1] += temp_res[i] / 2;
-                temp_res[i] %= 2;
-            }
-        }
-
-        res.setDigits(temp_res);
-        res.normalize();
-
+        LongNumber res = exactProduct(*this, other);
+        res.setPrecision(std::max(this->precision, other.getPrecision()));
         return res;
     }
 
+    // the quotient is truncated to the larger of the operands' precisions
     LongNumber LongNumber::operator/(const LongNumber& other) const {
-        LongNumber dividend = this->abs();
-        LongNumber divisor = other.abs();
-        dividend.alignPrecision(divisor);
-    
-        LongNumber res;
-        res.setPointId(dividend.getPointId());
-        res.setSign(this->sign ^ other.sign);
-        std::vector<short> result_digits(dividend.digits.size(), 0);
-    
-        LongNumber remainder;
-        for (size_t i = 0; i < dividend.digits.size(); i++) {
-            remainder.digits.push_back(dividend.digits[i]);
-            remainder.normalize();
+        if (other.isZero()) {
+            throw std::invalid_argument("Division by zero.");
+        }
+
+        int precision = std::max(this->precision, other.getPrecision());
+        unsigned long int dividend_frac = this->digits.size() - this->point_id;
+        unsigned long int divisor_frac = other.digits.size() - other.point_id;
+
+        // a / b = (A * 2^(divisor_frac + precision)) / (B * 2^dividend_frac) * 2^(-precision),
+        // where A and B are the digits read as integers
+        std::vector<short> dividend = this->digits;
+        dividend.resize(dividend.size() + divisor_frac + precision, 0);
+        std::vector<short> divisor = other.digits;
+        divisor.resize(divisor.size() + dividend_frac, 0);
+        divisor.insert(divisor.begin(), 0);
+
+        // the remainder is always less than the divisor,
+        // so it fits into divisor.size() digits after the shift
+        std::vector<short> result_digits(dividend.size(), 0);
+        std::vector<short> remainder(divisor.size(), 0);
+        ProgressLoop loop;
+        for (size_t i = 0; i < dividend.size(); i++) {
+            loop.step(i, dividend.size());
+            remainder.erase(remainder.begin());
+            remainder.push_back(dividend[i]);
     
             if (remainder >= divisor) {
-                remainder = remainder - divisor;
+                int borrow = 0;
+                for (int j = remainder.size() - 1; j >= 0; j--) {
+                    int diff = remainder[j] - divisor[j] - borrow;
+                    borrow = (diff < 0);
+                    remainder[j] = diff + 2 * borrow;
+                }
                 result_digits[i] = 1;
             }
         }
     
+        LongNumber res;
+        res.setSign(this->sign ^ other.sign);
+        res.precision = precision;
         res.setDigits(result_digits);
+        res.setPointId(result_digits.size() - precision);
         res.normalize();
         return res;
     }
@@ -337,22 +414,15 @@ namespace LongNumbers{
 
     // comparison operators
     bool LongNumber::operator == (const LongNumber& other) const {
-        std::vector<short> this_digits = this->digits;
-        std::vector<short> other_digits = other.getDigits();
-    
-        auto max_precision = std::max(this->precision, other.getPrecision());
-        while (this_digits.size() < max_precision + this->point_id) {
-            this_digits.push_back(0);
-        }
-        while (other_digits.size() < max_precision + other.getPointId()) {
-            other_digits.push_back(0);
-        }
+        LongNumber a = *this, b = other;
+        a.alignPrecision(b);
+        b.alignPrecision(a);
     
-        if (this_digits != other_digits) {
+        if (a.digits != b.digits) {
             return false;
         }
     
-        return this->sign == other.getSign();
+        return a.sign == b.sign || a.isZero();
     }
     
 
@@ -367,38 +437,13 @@ namespace LongNumbers{
         if (this->sign == 0 && other.getSign() == 1){ return true; }
         
         // signs are the same
-        // -> checking the integer parts
-
-        // lengths of the integers differ:
-        if (this->point_id > other.getPointId()){ return this->sign == 0; }
-        if (this->point_id < other.getPointId()){ return this->sign != 0; }
-
-        // lengths of the integers match:
-        std::vector<short> other_digits = other.getDigits();
-        for (auto i = 0; i < this->point_id; i++) {
-            if (this->digits[i] > other_digits[i]) {
-                return this->sign == 0;
-            }
-            if (this->digits[i] < other_digits[i]) {
-                return !this->sign == 0;
-            }
-        }
-
-        // integers match
-        // -> checking fraction parts
-        auto frac_size = std::max(this->digits.size() - this->point_id, other_digits.size() - other.getPointId());
-        for (auto i = 0; i < frac_size; i++){
-            short this_digit = (i + this->point_id < this->digits.size()) ? this->digits[i + this->point_id] : 0;
-            short other_digit = (i + other.getPointId() < other_digits.size()) ? other_digits[i + other.getPointId()] : 0;
+        // -> comparing the magnitudes digit by digit
+        LongNumber a = *this, b = other;
+        a.alignPrecision(b);
+        b.alignPrecision(a);
 
-            if (this_digit > other_digit) {
-                return this->sign == 0;
-            }
-            if (this_digit < other_digit) {
-                return !this->sign == 0;
-            }
-        }
-        return false;
+        bool greater_magnitude = a.digits > b.digits;
+        return (this->sign == 0) ? greater_magnitude : !greater_magnitude;
     }
 
     bool LongNumber::operator >= (const LongNumber& other) const{
@@ -421,34 +466,105 @@ namespace LongNumbers{
             oss << "-";
         }
 
-        // binary integer -> decimal integer
-        unsigned long long integer_part = 0;
+        // binary integer -> decimal integer:
+        // doubling the digit string and adding the next binary digit
+        std::string integer_str = "0";
         for (size_t i = 0; i < point_id; ++i) {
-            integer_part = integer_part * 2 + digits[i];
+            int carry = digits[i];
+            for (size_t j = integer_str.size(); j-- > 0;) {
+                int cur = (integer_str[j] - '0') * 2 + carry;
+                integer_str[j] = static_cast<char>('0' + cur % 10);
+                carry = cur / 10;
+            }
+            if (carry) {
+                integer_str.insert(integer_str.begin(), '1');
+            }
         }
-        oss << integer_part;
+        oss << integer_str;
 
-        // binary fraction -> decimal fraction
+        // binary fraction -> decimal fraction:
+        // (digit + fraction) / 2 from the last binary digit, the result is exact
         if (point_id < digits.size()) {
             oss << ".";
-            double fractional_part = 0.0;
-            for (size_t i = point_id; i < digits.size(); i++) {
-                fractional_part = fractional_part * 2 + digits[i];
+            std::string fraction_str;
+            for (size_t i = digits.size(); i-- > point_id;) {
+                std::string halved;
+                int remainder = digits[i];
+                for (char c : fraction_str) {
+                    int cur = remainder * 10 + (c - '0');
+                    halved += static_cast<char>('0' + cur / 2);
+                    remainder = cur % 2;
+                }
+                if (remainder) {
+                    halved += '5';
+                }
+                fraction_str = halved;
             }
 
-            // converting to string
-            int precision = this->precision;
-            for (int i = 0; i < precision; i++) {
-                fractional_part *= 10;
-                int digit = static_cast<int>(fractional_part);
-                oss << digit;
-                fractional_part -= digit;
-            }
+            // as many decimal digits as the precision
+            fraction_str.resize(std::max(this->precision, 0), '0');
+            oss << fraction_str;
         }
 
         return oss.str();
     }
 
+    // keeps every digit of the product: its precision is the sum of the operands' ones
+    LongNumber exactProduct(const LongNumber& a, const LongNumber& b) {
+        std::vector<short> multiplicand_digits = a.getDigits();
+        std::vector<short> multiplier_digits = b.getDigits();
+
+        LongNumber res;
+        bool res_sign = a.getSign() ^ b.getSign();
+        res.setSign(res_sign);
+        res.setPointId(a.getPointId() + b.getPointId());
+
+        // digits are stored from the most significant one,
+        // so digits i and j of the operands land in the digit i + j + 1 of the product
+        std::vector<int> temp_res(multiplicand_digits.size() + multiplier_digits.size(), 0);
+        ProgressLoop loop;
+        for (size_t i = 0; i < multiplicand_digits.size(); i++) {
+            loop.step(i, multiplicand_digits.size());
+            if (multiplicand_digits[i] == 0) { continue; }
+            for (size_t j = 0; j < multiplier_digits.size(); j++) {
+                temp_res[i + j + 1] += multiplier_digits[j];
+            }
+        }
+
+        for (size_t i = temp_res.size() - 1; i > 0; i--) {
+            temp_res[i - 1] += temp_res[i] / 2;
+            temp_res[i] %= 2;
+        }
+
+        res.setDigits(std::vector<short>(temp_res.begin(), temp_res.end()));
+        res.setPrecision(a.getPrecision() + b.getPrecision());
+
+        return res;
+    }
+
+    // constants
+
+    // Leibniz formula
+    LongNumber computePi(int precision) {
+        LongNumber pi("0.0", precision);
+        LongNumber one("1.0", precision);
+        LongNumber four("4.0", precision);
+
+        int maxIterations = precision * 10;
+
+        ProgressLoop loop;
+        for (int i = 0; i < maxIterations; ++i) {
+            loop.step(i, maxIterations);
+            LongNumber term = one / LongNumber(std::to_string(2 * i + 1), precision); // (1 / (2i + 1))
+            if (i % 2 == 0) {
+                pi = pi + term; 
+            } else {
+                pi = pi - term;
+            }
+        }
+
+        return four * pi;
+    }
 
     LongNumber operator ""_longnum(long double num){
         return LongNumber(num);
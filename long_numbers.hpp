@@ -5,8 +5,28 @@
 #include <string>
 #include <math.h>
 #include <sstream>
+#include <stdexcept>
 
 namespace LongNumbers {
+    // thrown from long-running loops when the observer asks to stop
+    class ComputationCancelled : public std::runtime_error{
+    public:
+        ComputationCancelled();
+    };
+
+    // progress and cancellation hook of long-running loops (division, multiplication, pi);
+    // only the outermost loop reports progress, nested ones just check for cancellation
+    class ComputationObserver{
+    public:
+        virtual ~ComputationObserver() = default;
+        virtual bool isCancelled() const = 0;
+        virtual void onProgress(double done) = 0;
+    };
+
+    // observer of the computations running in the calling thread (nullptr to detach)
+    void setObserver(ComputationObserver* observer);
+    ComputationObserver* getObserver();
+
     class LongNumber{
 
     private:
@@ -62,6 +82,12 @@ namespace LongNumbers {
         std::string toString() const;
     };
 
+    // product without truncation, its precision is the sum of the operands' ones
+    LongNumber exactProduct(const LongNumber& a, const LongNumber& b);
+
+    // constants
+    LongNumber computePi(int precision);
+
     //LongNumber operator ""_longnum(long double num);
     //LongNumber operator ""_longnum(unsigned long long num);
 
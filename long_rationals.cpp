@@ -0,0 +1,463 @@
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include "long_rationals.hpp"
+#include "decimal_long_numbers.hpp"
+
+namespace LongNumbers{
+    namespace {
+        using Limbs = std::vector<uint64_t>; // base 2^64, least significant first, empty is zero
+        using Wide = unsigned __int128;
+
+        // signed integer for the gcd cofactors
+        struct SignedLimbs {
+            Limbs magnitude;
+            bool negative;
+        };
+
+        void trim(Limbs& a) {
+            while (!a.empty() && a.back() == 0) { a.pop_back(); }
+        }
+
+        unsigned long int bitLength(const Limbs& a) {
+            if (a.empty()) { return 0; }
+            return 64 * a.size() - __builtin_clzll(a.back());
+        }
+
+        // magnitudes must be trimmed
+        int compare(const Limbs& a, const Limbs& b) {
+            if (a.size() != b.size()) { return (a.size() > b.size()) ? 1 : -1; }
+            for (size_t i = a.size(); i-- > 0;) {
+                if (a[i] != b[i]) { return (a[i] > b[i]) ? 1 : -1; }
+            }
+            return 0;
+        }
+
+        Limbs add(const Limbs& a, const Limbs& b) {
+            Limbs res(std::max(a.size(), b.size()) + 1, 0);
+            uint64_t carry = 0;
+            for (size_t i = 0; i < res.size(); i++) {
+                Wide sum = static_cast<Wide>(carry) + (i < a.size() ? a[i] : 0) + (i < b.size() ? b[i] : 0);
+                res[i] = static_cast<uint64_t>(sum);
+                carry = static_cast<uint64_t>(sum >> 64);
+            }
+            trim(res);
+            return res;
+        }
+
+        // a >= b
+        Limbs subtract(const Limbs& a, const Limbs& b) {
+            Limbs res(a.size(), 0);
+            uint64_t borrow = 0;
+            for (size_t i = 0; i < a.size(); i++) {
+                uint64_t subtrahend = (i < b.size() ? b[i] : 0);
+                uint64_t diff = a[i] - subtrahend - borrow;
+                borrow = (a[i] < subtrahend) || (a[i] - subtrahend < borrow);
+                res[i] = diff;
+            }
+            trim(res);
+            return res;
+        }
+
+        Limbs multiplySmall(const Limbs& a, uint64_t factor) {
+            Limbs res(a.size() + 1, 0);
+            uint64_t carry = 0;
+            for (size_t i = 0; i < a.size(); i++) {
+                Wide cur = static_cast<Wide>(a[i]) * factor + carry;
+                res[i] = static_cast<uint64_t>(cur);
+                carry = static_cast<uint64_t>(cur >> 64);
+            }
+            res[a.size()] = carry;
+            trim(res);
+            return res;
+        }
+
+        Limbs multiply(const Limbs& a, const Limbs& b) {
+            Limbs res(a.size() + b.size(), 0);
+            for (size_t i = 0; i < a.size(); i++) {
+                uint64_t carry = 0;
+                for (size_t j = 0; j < b.size(); j++) {
+                    Wide cur = static_cast<Wide>(a[i]) * b[j] + res[i + j] + carry;
+                    res[i + j] = static_cast<uint64_t>(cur);
+                    carry = static_cast<uint64_t>(cur >> 64);
+                }
+                res[i + b.size()] = carry;
+            }
+            trim(res);
+            return res;
+        }
+
+        Limbs shiftLeft(const Limbs& a, unsigned long int bits) {
+            if (a.empty()) { return a; }
+            Limbs res(bits / 64, 0);
+            int shift = bits % 64;
+            uint64_t carry = 0;
+            for (auto limb : a) {
+                res.push_back((limb << shift) | carry);
+                carry = (shift == 0) ? 0 : limb >> (64 - shift);
+            }
+            res.push_back(carry);
+            trim(res);
+            return res;
+        }
+
+        void shiftRightOne(Limbs& a) {
+            for (size_t i = 0; i < a.size(); i++) {
+                a[i] = (a[i] >> 1) | ((i + 1 < a.size()) ? a[i + 1] << 63 : 0);
+            }
+            trim(a);
+        }
+
+        // lowest 64 bits of a >> bits
+        uint64_t bitsAfterShift(const Limbs& a, unsigned long int bits) {
+            size_t index = bits / 64;
+            int shift = bits % 64;
+            uint64_t low = (index < a.size()) ? a[index] >> shift : 0;
+            uint64_t high = (shift != 0 && index + 1 < a.size()) ? a[index + 1] << (64 - shift) : 0;
+            return low | high;
+        }
+
+        // shift-and-subtract division, its cost grows with the length of the quotient
+        void divide(const Limbs& u, const Limbs& v, Limbs& quotient, Limbs& remainder) {
+            quotient.clear();
+            remainder = u;
+            if (compare(u, v) < 0) { return; }
+
+            unsigned long int shift = bitLength(u) - bitLength(v);
+            Limbs shifted = shiftLeft(v, shift);
+            quotient.assign(shift / 64 + 1, 0);
+            for (unsigned long int k = shift + 1; k-- > 0;) {
+                if (compare(remainder, shifted) >= 0) {
+                    remainder = subtract(remainder, shifted);
+                    quotient[k / 64] |= uint64_t(1) << (k % 64);
+                }
+                shiftRightOne(shifted);
+            }
+            trim(quotient);
+        }
+
+        SignedLimbs signedAdd(const SignedLimbs& x, const SignedLimbs& y) {
+            if (x.negative == y.negative) {
+                return {add(x.magnitude, y.magnitude), x.negative};
+            }
+            if (compare(x.magnitude, y.magnitude) >= 0) {
+                Limbs diff = subtract(x.magnitude, y.magnitude);
+                return {diff, x.negative && !diff.empty()};
+            }
+            return {subtract(y.magnitude, x.magnitude), y.negative};
+        }
+
+        SignedLimbs signedScale(const SignedLimbs& x, int64_t factor) {
+            uint64_t magnitude = (factor < 0) ? -static_cast<uint64_t>(factor) : factor;
+            Limbs res = multiplySmall(x.magnitude, magnitude);
+            return {res, (x.negative != (factor < 0)) && !res.empty()};
+        }
+
+        // a * x + b * y for single word x and y
+        SignedLimbs combine(const SignedLimbs& a, int64_t x, const SignedLimbs& b, int64_t y) {
+            return signedAdd(signedScale(a, x), signedScale(b, y));
+        }
+
+        // cofactors of the gcd computation: u = s[0] * a + t[0] * b, v = s[1] * a + t[1] * b
+        struct Cofactors {
+            SignedLimbs s[2];
+            SignedLimbs t[2];
+
+            void swap() {
+                std::swap(s[0], s[1]);
+                std::swap(t[0], t[1]);
+            }
+
+            // (u, v) -> (v, u - q * v)
+            void euclidStep(const Limbs& q) {
+                SignedLimbs s_next = signedAdd(s[0], {multiply(q, s[1].magnitude), !s[1].negative && !s[1].magnitude.empty()});
+                SignedLimbs t_next = signedAdd(t[0], {multiply(q, t[1].magnitude), !t[1].negative && !t[1].magnitude.empty()});
+                s[0] = s[1]; s[1] = s_next;
+                t[0] = t[1]; t[1] = t_next;
+            }
+
+            // (u, v) -> (A * u + B * v, C * u + D * v)
+            void lehmerStep(int64_t A, int64_t B, int64_t C, int64_t D) {
+                SignedLimbs s0 = combine(s[0], A, s[1], B), s1 = combine(s[0], C, s[1], D);
+                SignedLimbs t0 = combine(t[0], A, t[1], B), t1 = combine(t[0], C, t[1], D);
+                s[0] = s0; s[1] = s1;
+                t[0] = t0; t[1] = t1;
+            }
+        };
+
+        // Lehmer's gcd: Euclid steps are simulated on the leading 62 bits
+        // and applied to the full numbers at once; cofactors are tracked if given
+        Limbs gcdLimbs(Limbs u, Limbs v, Cofactors* cofactors) {
+            const int WINDOW_BITS = 62;
+
+            while (!v.empty()) {
+                if (compare(u, v) < 0) {
+                    std::swap(u, v);
+                    if (cofactors) { cofactors->swap(); }
+                    if (v.empty()) { break; }
+                }
+
+                // both numbers fit into one word -> plain Euclid
+                if (u.size() == 1) {
+                    Limbs q = {u[0] / v[0]};
+                    Limbs r = {u[0] % v[0]};
+                    trim(r);
+                    if (cofactors) { cofactors->euclidStep(q); }
+                    u = v;
+                    v = r;
+                    continue;
+                }
+
+                unsigned long int shift = bitLength(u) - WINDOW_BITS;
+                __int128 u_head = bitsAfterShift(u, shift), v_head = bitsAfterShift(v, shift);
+                __int128 A = 1, B = 0, C = 0, D = 1;
+                while (v_head + C > 0 && v_head + D > 0) {
+                    __int128 q = (u_head + A) / (v_head + C);
+                    if (q != (u_head + B) / (v_head + D)) { break; }
+
+                    __int128 T = A - q * C; A = C; C = T;
+                    T = B - q * D; B = D; D = T;
+                    T = u_head - q * v_head; u_head = v_head; v_head = T;
+                }
+
+                if (B == 0) {
+                    // the leading bits are not enough for a single step -> one full division
+                    Limbs q, r;
+                    divide(u, v, q, r);
+                    if (cofactors) { cofactors->euclidStep(q); }
+                    u = v;
+                    v = r;
+                } else {
+                    SignedLimbs u_signed = {u, false}, v_signed = {v, false};
+                    u = combine(u_signed, A, v_signed, B).magnitude;
+                    v = combine(u_signed, C, v_signed, D).magnitude;
+                    if (cofactors) { cofactors->lehmerStep(A, B, C, D); }
+                }
+            }
+
+            return u;
+        }
+
+        // all the digits of a LongNumber read as an integer,
+        // the number itself is that integer over 2^(digits after the point)
+        Limbs digitsToLimbs(const LongNumber& num) {
+            std::vector<short> digits = num.getDigits();
+            Limbs res((digits.size() + 63) / 64, 0);
+            for (size_t i = 0; i < digits.size(); i++) {
+                size_t position = digits.size() - 1 - i;
+                res[position / 64] |= static_cast<uint64_t>(digits[i]) << (position % 64);
+            }
+            trim(res);
+            return res;
+        }
+
+        unsigned long int fractionSize(const LongNumber& num) {
+            return num.getDigits().size() - num.getPointId();
+        }
+
+        // integer LongNumber -> its magnitude
+        Limbs toLimbs(const LongNumber& num) {
+            std::vector<short> digits = num.getDigits();
+            unsigned long int point_id = num.getPointId();
+            for (size_t i = point_id; i < digits.size(); i++) {
+                if (digits[i] != 0) {
+                    throw std::invalid_argument("LongNumber is not an integer.");
+                }
+            }
+
+            Limbs res((point_id + 63) / 64, 0);
+            for (unsigned long int i = 0; i < point_id; i++) {
+                unsigned long int position = point_id - 1 - i;
+                res[position / 64] |= static_cast<uint64_t>(digits[i]) << (position % 64);
+            }
+            trim(res);
+            return res;
+        }
+
+        // magnitude -> integer LongNumber (precision 0)
+        LongNumber fromLimbs(const Limbs& magnitude, bool negative) {
+            std::vector<short> digits;
+            for (size_t i = magnitude.size(); i-- > 0;) {
+                for (int bit = 63; bit >= 0; bit--) {
+                    digits.push_back((magnitude[i] >> bit) & 1);
+                }
+            }
+            if (digits.empty()) { digits.push_back(0); }
+
+            LongNumber res;
+            res.setDigits(digits);
+            res.setPointId(digits.size());
+            res.setSign(negative);
+            res.setPrecision(0);
+            return res;
+        }
+
+        LongNumber negate(const LongNumber& num) {
+            LongNumber res = num;
+            if (!res.isZero()) { res.setSign(!res.getSign()); }
+            return res;
+        }
+    }
+
+    LongNumber gcd(const LongNumber& a, const LongNumber& b) {
+        return fromLimbs(gcdLimbs(toLimbs(a), toLimbs(b), nullptr), false);
+    }
+
+    LongNumber xgcd(const LongNumber& a, const LongNumber& b, LongNumber& x, LongNumber& y) {
+        // |a| = 1 * |a| + 0 * |b|, |b| = 0 * |a| + 1 * |b|
+        Cofactors cofactors = {{{{1}, false}, {{}, false}}, {{{}, false}, {{1}, false}}};
+        Limbs g = gcdLimbs(toLimbs(a), toLimbs(b), &cofactors);
+
+        x = fromLimbs(cofactors.s[0].magnitude, cofactors.s[0].negative != a.getSign());
+        y = fromLimbs(cofactors.t[0].magnitude, cofactors.t[0].negative != b.getSign());
+        return fromLimbs(g, false);
+    }
+
+    // getters
+    LongNumber LongRational::getNumerator() const{
+        return this->numerator;
+    }
+
+    LongNumber LongRational::getDenominator() const{
+        return this->denominator;
+    }
+
+    // auxiliary functions
+
+    // bits in the numerator and the denominator
+    unsigned long int LongRational::size() const{
+        return this->numerator.getPointId() + this->denominator.getPointId();
+    }
+
+    // reduces only when the numbers doubled since the last reduction
+    void LongRational::reduceIfLarge(){
+        if (size() > std::max(REDUCE_THRESHOLD, 2 * this->reduced_size)) {
+            reduce();
+        }
+    }
+
+    void LongRational::reduce(){
+        Limbs numerator_limbs = toLimbs(this->numerator);
+        Limbs denominator_limbs = toLimbs(this->denominator);
+        Limbs g = gcdLimbs(numerator_limbs, denominator_limbs, nullptr);
+
+        if (g != Limbs{1}) {
+            Limbs quotient, remainder;
+            divide(numerator_limbs, g, quotient, remainder);
+            this->numerator = fromLimbs(quotient, this->numerator.getSign());
+            divide(denominator_limbs, g, quotient, remainder);
+            this->denominator = fromLimbs(quotient, false);
+        }
+        this->reduced_size = size();
+    }
+
+    bool LongRational::isZero() const{
+        return this->numerator.isZero();
+    }
+
+    // constructors
+
+    // no arguments constructor (aka 0/1)
+    LongRational::LongRational() : numerator("0"), denominator("1"), reduced_size(0) {};
+
+    LongRational::LongRational(const LongNumber& numerator) : LongRational(numerator, LongNumber("1")) {};
+
+    LongRational::LongRational(const LongNumber& numerator, const LongNumber& denominator) : reduced_size(0) {
+        if (denominator.isZero()) {
+            throw std::invalid_argument("Denominator of LongRational cannot be zero.");
+        }
+
+        // (a / 2^k) / (b / 2^m) = (a * 2^m) / (b * 2^k), where a and b are the digits read as integers;
+        // both parts become integers of precision 0 with a positive denominator
+        bool negative = numerator.getSign() != denominator.getSign();
+        this->numerator = fromLimbs(shiftLeft(digitsToLimbs(numerator), fractionSize(denominator)),
+                                    negative && !numerator.isZero());
+        this->denominator = fromLimbs(shiftLeft(digitsToLimbs(denominator), fractionSize(numerator)), false);
+
+        reduceIfLarge();
+    }
+
+    // arithmetic operators
+    LongRational LongRational::operator + (const LongRational& other) const{
+        LongRational res;
+        res.numerator = this->numerator * other.denominator + other.numerator * this->denominator;
+        res.denominator = this->denominator * other.denominator;
+        res.reduced_size = this->reduced_size + other.reduced_size;
+        res.reduceIfLarge();
+        return res;
+    }
+
+    LongRational LongRational::operator - (const LongRational& other) const{
+        // a - b = a + (-b)
+        LongRational new_other = other;
+        new_other.numerator = negate(other.numerator);
+        return *this + new_other;
+    }
+
+    LongRational LongRational::operator * (const LongRational& other) const{
+        LongRational res;
+        res.numerator = this->numerator * other.numerator;
+        res.denominator = this->denominator * other.denominator;
+        res.reduced_size = this->reduced_size + other.reduced_size;
+        res.reduceIfLarge();
+        return res;
+    }
+
+    LongRational LongRational::operator / (const LongRational& other) const{
+        if (other.isZero()) {
+            throw std::invalid_argument("Division by zero.");
+        }
+
+        LongRational res;
+        res.numerator = this->numerator * other.denominator;
+        res.denominator = this->denominator * other.numerator;
+        if (res.denominator.getSign()) {
+            res.numerator = negate(res.numerator);
+            res.denominator = negate(res.denominator);
+        }
+        res.reduced_size = this->reduced_size + other.reduced_size;
+        res.reduceIfLarge();
+        return res;
+    }
+
+    // comparison operators
+    // denominators are positive, so a/b ? c/d is the same as a*d ? c*b
+    bool LongRational::operator == (const LongRational& other) const{
+        return this->numerator * other.denominator == other.numerator * this->denominator;
+    }
+
+    bool LongRational::operator != (const LongRational& other) const{
+        return !(*this == other);
+    }
+
+    bool LongRational::operator > (const LongRational& other) const{
+        return this->numerator * other.denominator > other.numerator * this->denominator;
+    }
+
+    bool LongRational::operator >= (const LongRational& other) const{
+        return (*this == other || *this > other);
+    }
+
+    bool LongRational::operator <= (const LongRational& other) const{
+        return !(*this > other);
+    }
+
+    bool LongRational::operator < (const LongRational& other) const{
+        return !(*this >= other);
+    }
+
+    // output methods
+    std::string LongRational::toString() const{
+        LongRational reduced = *this;
+        reduced.reduce();
+        return DecimalLongNumber(reduced.numerator, 0).toString() + "/" + DecimalLongNumber(reduced.denominator, 0).toString();
+    }
+
+    LongNumber LongRational::toLongNumber(int precision) const{
+        LongNumber res = this->numerator;
+        res.setPrecision(precision);
+        return res / this->denominator;
+    }
+} // namespace LongNumbers
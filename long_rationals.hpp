@@ -0,0 +1,62 @@
+#ifndef HEADER_GUARD_LONG_RATIONALS_HPP_INCLUDED
+#define HEADER_GUARD_LONG_RATIONALS_HPP_INCLUDED
+
+#include <string>
+#include "long_numbers.hpp"
+
+namespace LongNumbers {
+    // greatest common divisor of integers (Lehmer's algorithm), always non-negative
+    LongNumber gcd(const LongNumber& a, const LongNumber& b);
+    // also finds x and y such that a * x + b * y = gcd(a, b)
+    LongNumber xgcd(const LongNumber& a, const LongNumber& b, LongNumber& x, LongNumber& y);
+
+    // exact fraction of two integers, built exactly from any LongNumbers;
+    // reducing by gcd is delayed until the numbers grow past REDUCE_THRESHOLD bits or until output
+    class LongRational{
+
+    private:
+        LongNumber numerator;
+        LongNumber denominator; // always positive
+        unsigned long int reduced_size;
+
+        unsigned long int size() const;
+        void reduceIfLarge();
+
+    public:
+        static constexpr unsigned long int REDUCE_THRESHOLD = 256;
+
+        // getters
+        LongNumber getNumerator() const;
+        LongNumber getDenominator() const;
+
+        //auxiliary functions
+        void reduce();
+        bool isZero() const;
+
+        // constructors
+        LongRational();
+        LongRational(const LongNumber& numerator);
+        LongRational(const LongNumber& numerator, const LongNumber& denominator);
+
+        // arithmetic operators
+        LongRational operator + (const LongRational& other) const;
+        LongRational operator - (const LongRational& other) const;
+        LongRational operator * (const LongRational& other) const;
+        LongRational operator / (const LongRational& other) const;
+
+        // comparison operators
+        bool operator == (const LongRational& other) const;
+        bool operator != (const LongRational& other) const;
+        bool operator > (const LongRational& other) const;
+        bool operator >= (const LongRational& other) const;
+        bool operator <= (const LongRational& other) const;
+        bool operator < (const LongRational& other) const;
+
+        // output methods
+        std::string toString() const;
+        // truncated to the given amount of binary digits after the point
+        LongNumber toLongNumber(int precision) const;
+    };
+}
+
+#endif
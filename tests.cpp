@@ -2,6 +2,10 @@
 #include <vector>
 #include <string>
 #include "long_numbers.hpp"
+#include "long_intervals.hpp"
+#include "long_async.hpp"
+#include "decimal_long_numbers.hpp"
+#include "long_rationals.hpp"
 
 using namespace LongNumbers;
 
@@ -90,7 +94,7 @@ void runTests() {
     LongNumber num12("2.5", 1); // 10.1
     LongNumber num13("1.5", 1);  // 1.1
     LongNumber mult = num12 * num13;
-    if (mult == LongNumber("3.75", 2)) { // 11.11
+    if (mult == LongNumber("3.5", 1) && exactProduct(num12, num13) == LongNumber("3.75", 2)) { // 11.1, exactly 11.11
         std::cout << "Test 8 (mulitplication): OK\n";
     } else {
         std::cout << "Test 8 (mulitplication): FAIL\n";
@@ -163,6 +167,253 @@ void runTests() {
     } else {
         std::cout << "Test 15 (<): FAIL\n";
     }
+
+    // Test 16: interval division
+    LongInterval third = LongInterval(LongNumber("1.0", 10)) / LongInterval(LongNumber("3.0", 10));
+    LongNumber three("3.0", 10);
+    LongNumber one("1.0", 10);
+    if (third.getLower() * three <= one && one <= third.getUpper() * three && third.width() <= ulp(9)) {
+        std::cout << "Test 16 (interval division): OK\n";
+    } else {
+        std::cout << "Test 16 (interval division): FAIL\n";
+    }
+
+    // Test 17: adaptive evaluation
+    // 2/3 + 1/7 = 17/21
+    LongNumber adaptive = evaluate([](int precision) {
+        LongInterval two(LongNumber("2.0", precision));
+        LongInterval three(LongNumber("3.0", precision));
+        LongInterval seven(LongNumber("7.0", precision));
+        return two / three + LongInterval(LongNumber("1.0", precision)) / seven;
+    }, 20);
+    if (adaptive == LongNumber("17.0", 20) / LongNumber("21.0", 20)) {
+        std::cout << "Test 17 (adaptive evaluation): OK\n";
+    } else {
+        std::cout << "Test 17 (adaptive evaluation): FAIL\n";
+    }
+
+    // Test 18: interval division by zero
+    try {
+        LongInterval(LongNumber("1.0", 4)) / LongInterval(LongNumber("-1.0", 4), LongNumber("1.0", 4));
+        std::cout << "Test 18 (interval division by zero): FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "Test 18 (interval division by zero): OK\n";
+    }
+
+    // Test 19: async multiplication
+    LongNumber num30("13.5", 2);
+    LongNumber num31("-2.25", 2);
+    LongJob mult_job = asyncMultiply(num30, num31);
+    if (mult_job.get() == num30 * num31) {
+        std::cout << "Test 19 (async multiplication): OK\n";
+    } else {
+        std::cout << "Test 19 (async multiplication): FAIL\n";
+    }
+
+    // Test 20: async division progress
+    double last_progress = 0.0;
+    LongJob div_job = asyncDivide(LongNumber("1.0", 64), LongNumber("3.0", 64),
+                                  [&last_progress](double done) { last_progress = done; });
+    div_job.wait();
+    if (div_job.get() == LongNumber("1.0", 64) / LongNumber("3.0", 64) && last_progress == 1.0 && div_job.getProgress() == 1.0) {
+        std::cout << "Test 20 (async division progress): OK\n";
+    } else {
+        std::cout << "Test 20 (async division progress): FAIL\n";
+    }
+
+    // Test 21: async cancellation
+    LongJob pi_job = asyncComputePi(1000);
+    pi_job.cancel();
+    try {
+        pi_job.get();
+        std::cout << "Test 21 (async cancellation): FAIL\n";
+    } catch (const ComputationCancelled&) {
+        std::cout << "Test 21 (async cancellation): OK\n";
+    }
+
+    // Test 22: decimal string constructor and output
+    DecimalLongNumber num32("-12345678901234567890123.0456", 4);
+    if (num32.toString() == "-12345678901234567890123.0456" && num32.getLimbs().size() == 2) {
+        std::cout << "Test 22 (decimal string constructor): OK\n";
+    } else {
+        std::cout << "Test 22 (decimal string constructor): FAIL\n";
+    }
+
+    // Test 23: decimal arithmetic
+    DecimalLongNumber num33("1.5", 1);
+    DecimalLongNumber num34("2.25", 2);
+    DecimalLongNumber num35("9999999999999999999", 0);
+    if ((num33 * num34).toString() == "3.37" && (num34 * DecimalLongNumber("-1.5", 1)).toString() == "-3.37"
+        && (num33 - num34).toString() == "-0.75"
+        && (num35 + DecimalLongNumber("1")).toString() == "10000000000000000000"
+        && (DecimalLongNumber("1.0", 5) / DecimalLongNumber("3.0", 5)).toString() == "0.33333"
+        && num34 > num33) {
+        std::cout << "Test 23 (decimal arithmetic): OK\n";
+    } else {
+        std::cout << "Test 23 (decimal arithmetic): FAIL\n";
+    }
+
+    // Test 24: conversions between binary and decimal
+    DecimalLongNumber num36(LongNumber("-3.25", 2), 2);
+    if (DecimalLongNumber("5.625", 3).toLongNumber(3) == LongNumber("5.625", 3) && num36.toString() == "-3.25") {
+        std::cout << "Test 24 (decimal conversions): OK\n";
+    } else {
+        std::cout << "Test 24 (decimal conversions): FAIL\n";
+    }
+
+    // Test 25: gcd
+    LongNumber num37 = DecimalLongNumber("340282366920938463463374607431768211456").toLongNumber(0); // 2^128
+    LongNumber num38 = DecimalLongNumber("-55340232221128654848").toLongNumber(0); // -3 * 2^64
+    if (gcd(LongNumber("1071"), LongNumber("462")) == LongNumber("21")
+        && gcd(num37, num38) == DecimalLongNumber("18446744073709551616").toLongNumber(0)) {
+        std::cout << "Test 25 (gcd): OK\n";
+    } else {
+        std::cout << "Test 25 (gcd): FAIL\n";
+    }
+
+    // Test 26: xgcd
+    LongNumber num39 = DecimalLongNumber("123456789012345678901234567890").toLongNumber(0);
+    LongNumber num40 = DecimalLongNumber("-987654321098765432109876543211").toLongNumber(0);
+    LongNumber x, y;
+    LongNumber g = xgcd(num39, num40, x, y);
+    if (num39 * x + num40 * y == g && g == gcd(num39, num40)) {
+        std::cout << "Test 26 (xgcd): OK\n";
+    } else {
+        std::cout << "Test 26 (xgcd): FAIL\n";
+    }
+
+    // Test 27: rational arithmetic
+    LongRational third_part(LongNumber("1"), LongNumber("3"));
+    LongRational sixth_part(LongNumber("-1"), LongNumber("-6"));
+    LongRational half = third_part + sixth_part;
+    if (half.toString() == "1/2" && half == LongRational(LongNumber("2"), LongNumber("4"))
+        && (third_part - half).toString() == "-1/6" && third_part / sixth_part == LongRational(LongNumber("2"))
+        && half > third_part) {
+        std::cout << "Test 27 (rational arithmetic): OK\n";
+    } else {
+        std::cout << "Test 27 (rational arithmetic): FAIL\n";
+    }
+
+    // Test 28: rational to LongNumber
+    if (third_part.toLongNumber(10) == LongNumber("1.0", 10) / LongNumber("3.0", 10)) {
+        std::cout << "Test 28 (rational conversion): OK\n";
+    } else {
+        std::cout << "Test 28 (rational conversion): FAIL\n";
+    }
+
+    // Test 29: exact decimal string constructor
+    LongNumber num41("0.1", 100);
+    LongNumber num42("123456789012345678901234567890", 0);
+    if (num41 * LongNumber("10") != LongNumber("1") && num41 * LongNumber("10") > LongNumber("1") - ulp(99)
+        && DecimalLongNumber(num42, 0).toString() == "123456789012345678901234567890") {
+        std::cout << "Test 29 (exact decimal string constructor): OK\n";
+    } else {
+        std::cout << "Test 29 (exact decimal string constructor): FAIL\n";
+    }
+
+    // Test 30: adaptive evaluation to decimal digits
+    auto decimal_product = [](int precision) {
+        return LongInterval("0.1", precision) * LongInterval("3.0", precision);
+    };
+    DecimalLongNumber negative_third = evaluateDecimal([](int precision) {
+        return LongInterval(LongNumber("-1.0", precision)) / LongInterval(LongNumber("3.0", precision));
+    }, 5);
+    LongInterval exact_decimal("-0.375", 3);
+    if (evaluateDecimal(decimal_product, 25).toString() == "0.3000000000000000000000000"
+        && evaluateDecimal(decimal_product, 10).toString() == "0.3000000000" && negative_third.toString() == "-0.33334"
+        && exact_decimal.getLower() == exact_decimal.getUpper() && LongInterval("0.1", 10).contains(LongNumber("0.1", 10))) {
+        std::cout << "Test 30 (adaptive decimal evaluation): OK\n";
+    } else {
+        std::cout << "Test 30 (adaptive decimal evaluation): FAIL\n";
+    }
+
+    // Test 31: decimal output
+    LongNumber num43 = LongNumber("1", 100) / LongNumber("3", 100);
+    if (LongNumber("0.5", 1).toString() == "0.5" && LongNumber("-5.625", 3).toString() == "-5.625"
+        && LongNumber("123456789012345678901234567890", 0).toString() == "123456789012345678901234567890"
+        && num43.toString().substr(0, 32) == "0.333333333333333333333333333333") {
+        std::cout << "Test 31 (decimal output): OK\n";
+    } else {
+        std::cout << "Test 31 (decimal output): FAIL\n";
+    }
+
+    // Test 32: mixed sign addition and substraction
+    LongNumber num44("2.5", 1);   // 10.1
+    LongNumber num45("-3.75", 2); // -11.11
+    if (num44 + num45 == LongNumber("-1.25", 2) && num45 + num44 == LongNumber("-1.25", 2)
+        && num44 - num45 == LongNumber("6.25", 2) && num45 - num44 == LongNumber("-6.25", 2)
+        && (num45 - num45).isZero() && !(num45 - num45).getSign() && (num44 + LongNumber("-2.5", 1)) == LongNumber()) {
+        std::cout << "Test 32 (mixed sign addition): OK\n";
+    } else {
+        std::cout << "Test 32 (mixed sign addition): FAIL\n";
+    }
+
+    // Test 33: multiplication and division with negative operands
+    LongNumber num46("-1.5", 1);
+    LongNumber num47("-6.0", 1);
+    // products are truncated towards zero to the larger precision, exactProduct keeps every digit
+    if (num46 * num44 == LongNumber("-3.5", 1) && (num46 * num44).getPrecision() == 1
+        && exactProduct(num46, num44) == LongNumber("-3.75", 2) && num46 * num46 == LongNumber("2.0", 1)
+        && num47 / num46 == LongNumber("4.0", 1) && num47 / LongNumber("1.5", 1) == LongNumber("-4.0", 1)
+        && num46 > num47 && num47 < LongNumber()) {
+        std::cout << "Test 33 (negative multiplication and division): OK\n";
+    } else {
+        std::cout << "Test 33 (negative multiplication and division): FAIL\n";
+    }
+
+    // Test 34: division of numbers with different precisions
+    LongNumber num48("7.0", 0);
+    LongNumber num49("0.25", 8);
+    LongNumber quotient = num48 / num49;
+    LongNumber third_quotient = LongNumber("1.0", 2) / LongNumber("3.0", 6); // 0.010101
+    if (quotient == LongNumber("28.0", 8) && quotient.getPrecision() == 8
+        && third_quotient.getDigits() == std::vector<short>{0, 0, 1, 0, 1, 0, 1} && third_quotient.getPrecision() == 6) {
+        std::cout << "Test 34 (division with different precisions): OK\n";
+    } else {
+        std::cout << "Test 34 (division with different precisions): FAIL\n";
+    }
+
+    // Test 35: division by zero
+    try {
+        LongNumber("1.0", 2) / LongNumber("0.0", 2);
+        std::cout << "Test 35 (division by zero): FAIL\n";
+    } catch (const std::invalid_argument&) {
+        std::cout << "Test 35 (division by zero): OK\n";
+    }
+
+    // Test 36: rational from fractional LongNumbers
+    LongRational three_halves(LongNumber("1.5", 1));
+    LongRational quarter(LongNumber("-0.375", 3), LongNumber("1.5", 4));
+    if (three_halves.toString() == "3/2" && quarter.toString() == "-1/4"
+        && quarter.toLongNumber(2) == LongNumber("-0.25", 2)) {
+        std::cout << "Test 36 (rational from fractions): OK\n";
+    } else {
+        std::cout << "Test 36 (rational from fractions): FAIL\n";
+    }
+
+    // Test 37: repeated squaring keeps the precision
+    LongNumber power("1.000001", 20);
+    for (int i = 0; i < 5; i++) {
+        power = power * power;
+    }
+    if (power.getPrecision() == 20 && power.getDigits().size() == power.getPointId() + 20) {
+        std::cout << "Test 37 (product precision): OK\n";
+    } else {
+        std::cout << "Test 37 (product precision): FAIL\n";
+    }
+
+    // Test 38: adaptive evaluation of results on the rounding grid
+    LongNumber grid_half = evaluate([](int precision) {
+        return LongInterval("0.1", precision) * LongInterval("5", precision);
+    }, 30);
+    LongNumber cancelled = evaluate([](int precision) {
+        return LongInterval("0.3", precision) - LongInterval("0.1", precision) * LongInterval("3", precision);
+    }, 30);
+    if (grid_half == LongNumber("0.5", 30) && cancelled.isZero()) {
+        std::cout << "Test 38 (adaptive evaluation on the grid): OK\n";
+    } else {
+        std::cout << "Test 38 (adaptive evaluation on the grid): FAIL\n";
+    }
 }
 
 int main() {